@@ -3,6 +3,8 @@
 #include <sstream>
 #include <string>
 #include <map>
+#include <vector>
+#include <algorithm>
 using namespace std;
 // --- Data Structures for Tables ---
 class Symbol
@@ -10,12 +12,41 @@ class Symbol
 public:
     string name;
     int address;
+    int chain; // head of the backpatch chain in fixups, -1 if empty
 };
 class Literal
 {
 public:
     string name;
     int address;
+    int chain;
+};
+// A pending forward reference, linked into its symbol's (or literal's) chain
+class Fixup
+{
+public:
+    int target;    // index into code, or into symtab when isSymbol
+    int offset;    // added to the address once it is known ("L1+3")
+    bool isSymbol; // deferred EQU: target symbol is defined as address+offset
+    int next;      // next fixup in the same chain, -1 at the end
+};
+// Macro Name Table entry
+class MacroName
+{
+public:
+    string name;
+    int mdtIndex;   // first body line in the MDT
+    int mdtEnd;     // index of the macro's own MEND in the MDT
+    int paramCount;
+};
+// One word of final machine code (one-pass mode)
+class MachineWord
+{
+public:
+    int lc;
+    string opcode;
+    string reg;
+    int address;
 };
 class AssemblerPass1
 {
@@ -24,18 +55,33 @@ class AssemblerPass1
     string regTable[4][2];     // Register, Code
     int opcodeCount;
 
-    Symbol symtab[50];
-    Literal littab[50];
-    int pooltab[20];
+    // Grown on demand, like code and fixups below
+    vector<Symbol> symtab;
+    vector<Literal> littab;
+    vector<int> pooltab;
 
-    int symCount, litCount, poolCount;
     int LC; // Location Counter
 
+    // --- One-pass mode: code is generated directly and forward
+    // references are backpatched when their symbol gets an address ---
+    vector<MachineWord> code;
+    vector<Fixup> fixups;
+
+    // --- Macro stage: MNT, MDT and an expansion cache keyed by
+    // MNT index + actual arguments ---
+    vector<MacroName> mnt;
+    vector<string> mdt; // body lines, formals replaced by (P,i)
+    vector<string> formals;
+    int defineDepth; // >0 while inside MACRO ... MEND
+    bool expectPrototype;
+    map<string, vector<string>> expansionCache;
+    int expansionCount, cacheHits;
+
     // --- Helper Function to get a symbol's address ---
     // Used by EQU and ORIGIN
     int getSymbolAddress(string name)
     {
-        for (int i = 0; i < symCount; i++)
+        for (int i = 0; i < (int)symtab.size(); i++)
         {
             if (symtab[i].name == name)
             {
@@ -44,27 +90,23 @@ class AssemblerPass1
         }
         return -1; // Not found
     }
-    // --- Helper function to evaluate expressions ---
-    // Handles:
-    // 1. Constant ("300")
-    // 2. Symbol ("L1")
-    // 3. Symbol + Offset ("L1+3")
-    int evaluateExpression(string expression)
+    // --- Helper function to split "symbol+offset" ---
+    // Returns false if the whole expression is a constant (stored in offset)
+    bool splitExpression(string expression, string &symName, int &offset)
     {
         // Check for simple constant
         try
         {
-            return stoi(expression);
+            offset = stoi(expression);
+            return false;
         }
         catch (...)
         {
             // Not a simple integer, proceed
         }
 
-        // Parse "symbol+offset"
         size_t plusPos = expression.find('+');
-        string symName;
-        int offset = 0;
+        offset = 0;
 
         if (plusPos == string::npos)
         {
@@ -84,6 +126,38 @@ class AssemblerPass1
                 offset = 0;
             }
         }
+        return true;
+    }
+    // --- Helper function to convert a DC / literal constant ---
+    // A single character ('A') is stored as its character code
+    int constantValue(string text)
+    {
+        try
+        {
+            size_t used;
+            int value = stoi(text, &used);
+            if (used == text.length())
+                return value;
+        }
+        catch (...)
+        {
+        }
+        if (text.length() == 1)
+            return (unsigned char)text[0];
+        cout << "Error: Invalid constant: " << text << endl;
+        return 0;
+    }
+    // --- Helper function to evaluate expressions ---
+    // Handles:
+    // 1. Constant ("300")
+    // 2. Symbol ("L1")
+    // 3. Symbol + Offset ("L1+3")
+    int evaluateExpression(string expression)
+    {
+        string symName;
+        int offset;
+        if (!splitExpression(expression, symName, offset))
+            return offset;
 
         int symAddress = getSymbolAddress(symName);
         if (symAddress == -1)
@@ -172,10 +246,11 @@ public:
         regTable[3][1] = "04";
 
         // --- 5. Initialize Counters ---
-        symCount = litCount = 0;
-        poolCount = 1;
-        pooltab[0] = 0; // First pool starts at literal index 0
+        pooltab.push_back(0); // First pool starts at literal index 0
         LC = 0;
+        defineDepth = 0;
+        expectPrototype = false;
+        expansionCount = cacheHits = 0;
     }
 
     // --- Table Lookup Functions ---
@@ -230,47 +305,111 @@ public:
     // --- Symbol and Literal Table Management ---
     int addSymbol(string name, int address)
     {
-        for (int i = 0; i < symCount; i++)
+        for (int i = 0; i < (int)symtab.size(); i++)
         {
             if (symtab[i].name == name)
             {
                 if (address != -1)
                 {
                     symtab[i].address = address;
-                }
-                else if (symtab[i].address == -1 && address != -1)
-                {
-                    symtab[i].address = address;
+                    resolveFixups(symtab[i].chain, address);
                 }
                 return i;
             }
         }
 
-        symtab[symCount].name = name;
-        symtab[symCount].address = address;
-        symCount++;
-        return symCount - 1;
+        Symbol entry;
+        entry.name = name;
+        entry.address = address;
+        entry.chain = -1;
+        symtab.push_back(entry);
+        return symtab.size() - 1;
     }
     int addLiteral(string lit)
     {
-        for (int i = pooltab[poolCount - 1]; i < litCount; i++)
+        for (int i = pooltab.back(); i < (int)littab.size(); i++)
             if (littab[i].name == lit)
                 return i;
 
-        littab[litCount].name = lit;
-        littab[litCount].address = -1;
-        litCount++;
-        return litCount - 1;
+        Literal entry;
+        entry.name = lit;
+        entry.address = -1;
+        entry.chain = -1;
+        littab.push_back(entry);
+        return littab.size() - 1;
+    }
+
+    // --- Backpatching (one-pass mode) ---
+    void addFixup(int &chain, int target, int offset, bool isSymbol)
+    {
+        Fixup f;
+        f.target = target;
+        f.offset = offset;
+        f.isSymbol = isSymbol;
+        f.next = chain;
+        fixups.push_back(f);
+        chain = fixups.size() - 1;
+    }
+    // Walks a chain once its address is known; a deferred EQU defines
+    // another symbol, which in turn resolves that symbol's own chain
+    void resolveFixups(int &chain, int address)
+    {
+        int f = chain;
+        chain = -1;
+        while (f != -1)
+        {
+            int value = address + fixups[f].offset;
+            if (fixups[f].isSymbol)
+                addSymbol(symtab[fixups[f].target].name, value);
+            else
+                code[fixups[f].target].address = value;
+            f = fixups[f].next;
+        }
+    }
+    // Address of a symbol/literal operand for the word about to be
+    // emitted, or -1 with a fixup queued if it is not known yet
+    int referenceOperand(string operand)
+    {
+        if (operand[0] == '=')
+        {
+            int litIndex = addLiteral(operand);
+            if (littab[litIndex].address == -1)
+                addFixup(littab[litIndex].chain, code.size(), 0, false);
+            return littab[litIndex].address;
+        }
+
+        string symName;
+        int offset;
+        if (!splitExpression(operand, symName, offset))
+            return offset;
+        int symIndex = addSymbol(symName, -1);
+        if (symtab[symIndex].address == -1)
+        {
+            addFixup(symtab[symIndex].chain, code.size(), offset, false);
+            return -1;
+        }
+        return symtab[symIndex].address + offset;
+    }
+    void emitWord(string opcode, string reg, int address)
+    {
+        MachineWord word;
+        word.lc = LC;
+        word.opcode = opcode;
+        word.reg = reg;
+        word.address = address;
+        code.push_back(word);
+        LC++;
     }
 
     // --- Core Pass 1 Logic ---
     // (UPDATED) Assigns addresses to all literals in the current pool
-    void assignLiterals(ofstream &out)
+    // In one-pass mode `out` is null and the literals go straight into code
+    void assignLiterals(ofstream *out)
     {
         // --- FIX IS HERE ---
         // Check if there are any new literals to process
-        int currentPoolStart = pooltab[poolCount - 1];
-        if (currentPoolStart == litCount)
+        int currentPoolStart = pooltab.back();
+        if (currentPoolStart == (int)littab.size())
         {
             // This pool is empty (e.g., END called after LTORG).
             // Do NOT add a duplicate pool entry.
@@ -278,27 +417,31 @@ public:
         }
 
         // Process literals as before
-        for (int i = currentPoolStart; i < litCount; i++)
+        for (int i = currentPoolStart; i < (int)littab.size(); i++)
         {
             if (littab[i].address == -1)
             {
                 littab[i].address = LC;
+                resolveFixups(littab[i].chain, LC);
                 string litValue = littab[i].name.substr(2, littab[i].name.length() - 3);
-                out << "(" << LC << ") (DL,02) (C," << litValue << ")\n";
-                LC++;
+                if (out)
+                {
+                    *out << "(" << LC << ") (DL,02) (C," << litValue << ")\n";
+                    LC++;
+                }
+                else
+                {
+                    emitWord("00", "00", constantValue(litValue));
+                }
             }
         }
 
         // Now, add the new pool entry
-        pooltab[poolCount] = litCount;
-        poolCount++;
+        pooltab.push_back(littab.size());
     }
-    // Processes a single line of assembly code
-    void processLine(string line, ofstream &out)
+    // Splits a line into label, opcode and up to two operands
+    void parseLine(string line, string &label, string &opcode, string &op1, string &op2)
     {
-        if (line.empty())
-            return;
-        string label, opcode, op1, op2;
         stringstream ss(line);
         string firstWord;
 
@@ -315,6 +458,14 @@ public:
             label = firstWord;
             ss >> opcode >> op1 >> op2;
         }
+    }
+    // Processes a single line of assembly code
+    void processLine(string line, ofstream &out)
+    {
+        if (line.empty())
+            return;
+        string label, opcode, op1, op2;
+        parseLine(line, label, opcode, op1, op2);
 
         if (!label.empty() && opcode != "START" && opcode != "EQU")
         {
@@ -408,12 +559,332 @@ public:
         else if (opcode == "LTORG")
         {
             out << "(" << LC << ") (AD," << code << ")\n";
-            assignLiterals(out);
+            assignLiterals(&out);
         }
         else if (opcode == "END")
         {
             out << "(" << LC << ") (AD," << code << ")\n";
-            assignLiterals(out);
+            assignLiterals(&out);
+        }
+    }
+
+    // Processes a single line in one-pass mode: emits final machine code
+    // and queues forward references instead of writing intermediate code
+    void processLineOnePass(string line)
+    {
+        if (line.empty())
+            return;
+        string label, opcode, op1, op2;
+        parseLine(line, label, opcode, op1, op2);
+
+        if (!label.empty() && opcode != "START" && opcode != "EQU")
+        {
+            addSymbol(label, LC);
+        }
+
+        string cls = getOpClass(opcode);
+        string code = getOpCode(opcode);
+
+        if (opcode == "START")
+        {
+            LC = stoi(op1);
+            if (!label.empty())
+            {
+                addSymbol(label, LC);
+            }
+        }
+        else if (cls == "IS")
+        {
+            if (opcode == "STOP")
+            {
+                emitWord(code, "00", 0);
+            }
+            else if (opcode == "READ" || opcode == "PRINT")
+            {
+                int address = referenceOperand(op1);
+                emitWord(code, "00", address);
+            }
+            else if (opcode == "BC")
+            {
+                string cc = op1.substr(0, op1.find(','));
+                int address = referenceOperand(op2);
+                emitWord(code, getConditionCode(cc), address);
+            }
+            else
+            {
+                size_t commaPos = op1.find(',');
+                string regName = op1;
+                if (commaPos != string::npos)
+                {
+                    regName = op1.substr(0, commaPos);
+                }
+                int address = referenceOperand(op2);
+                emitWord(code, getRegCode(regName), address);
+            }
+        }
+        else if (opcode == "ORIGIN")
+        {
+            // LC is needed right away, so ORIGIN cannot be deferred
+            LC = evaluateExpression(op1);
+        }
+        else if (opcode == "EQU")
+        {
+            if (label.empty())
+            {
+                cout << "Error: EQU directive needs a label." << endl;
+                return;
+            }
+            string symName;
+            int offset;
+            if (!splitExpression(op1, symName, offset))
+            {
+                addSymbol(label, offset);
+                return;
+            }
+            int baseIndex = addSymbol(symName, -1);
+            if (symtab[baseIndex].address != -1)
+            {
+                addSymbol(label, symtab[baseIndex].address + offset);
+                return;
+            }
+            // Forward reference: define the label when the base is defined
+            int labelIndex = addSymbol(label, -1);
+            addFixup(symtab[baseIndex].chain, labelIndex, offset, true);
+        }
+        else if (opcode == "DC")
+        {
+            string constVal = op1.substr(1, op1.length() - 2);
+            emitWord("00", "00", constantValue(constVal));
+        }
+        else if (opcode == "DS")
+        {
+            LC += stoi(op1);
+        }
+        else if (opcode == "LTORG" || opcode == "END")
+        {
+            assignLiterals(nullptr);
+        }
+    }
+
+    // --- Macro Processing ---
+    // Searched from the back so a redefinition replaces earlier ones
+    int findMacro(string name)
+    {
+        for (int i = (int)mnt.size() - 1; i >= 0; i--)
+            if (mnt[i].name == name)
+                return i;
+        return -1;
+    }
+
+    // True when the just-closed definition (the last MNT entry) repeats
+    // the current definition of the same name line for line
+    bool sameAsPrevious()
+    {
+        MacroName &added = mnt.back();
+        for (int i = (int)mnt.size() - 2; i >= 0; i--)
+        {
+            if (mnt[i].name != added.name)
+                continue;
+            if (mnt[i].paramCount != added.paramCount ||
+                mnt[i].mdtEnd - mnt[i].mdtIndex != added.mdtEnd - added.mdtIndex)
+                return false;
+            return equal(mdt.begin() + mnt[i].mdtIndex, mdt.begin() + mnt[i].mdtEnd,
+                         mdt.begin() + added.mdtIndex);
+        }
+        return false;
+    }
+
+    // Replaces each "&NAME" formal with its positional marker (P,i)
+    string substituteFormals(string line)
+    {
+        string result;
+        for (size_t i = 0; i < line.length(); i++)
+        {
+            if (line[i] != '&')
+            {
+                result += line[i];
+                continue;
+            }
+            size_t j = i + 1;
+            while (j < line.length() && (isalnum(line[j]) || line[j] == '_'))
+                j++;
+            string name = line.substr(i + 1, j - i - 1);
+            size_t k = 0;
+            while (k < formals.size() && formals[k] != name)
+                k++;
+            if (k == formals.size())
+            {
+                // Parameters of a nested definition are resolved when it
+                // is itself defined during expansion
+                if (defineDepth == 1)
+                    cout << "Error: Unknown macro parameter &" << name << endl;
+                result += line.substr(i, j - i);
+            }
+            else
+            {
+                result += "(P," + to_string(k + 1) + ")";
+            }
+            i = j - 1;
+        }
+        return result;
+    }
+
+    // Records one line between MACRO and MEND
+    void defineLine(string line)
+    {
+        stringstream ss(line);
+        string first;
+        ss >> first;
+
+        if (expectPrototype)
+        {
+            if (first.empty())
+                return;
+            // Prototype: NAME &A, &B, ...
+            string params, param;
+            getline(ss, params);
+            for (char &c : params)
+                if (c == ',')
+                    c = ' ';
+            stringstream ps(params);
+            formals.clear();
+            while (ps >> param)
+                formals.push_back(param.substr(1));
+
+            MacroName entry;
+            entry.name = first;
+            entry.mdtIndex = entry.mdtEnd = mdt.size();
+            entry.paramCount = formals.size();
+            mnt.push_back(entry);
+            expectPrototype = false;
+            return;
+        }
+
+        // MEND is matched on its first token and stored normalized, so
+        // indentation or a trailing CR cannot hide the end of a body
+        if (first == "MEND")
+        {
+            defineDepth--;
+            if (defineDepth > 0)
+            {
+                mdt.push_back("MEND");
+                return;
+            }
+            mnt.back().mdtEnd = mdt.size();
+            if (sameAsPrevious())
+            {
+                // A nested definition replayed with the same arguments
+                mdt.resize(mnt.back().mdtIndex);
+                mnt.pop_back();
+                return;
+            }
+            mdt.push_back("MEND");
+            return;
+        }
+        if (first == "MACRO")
+            defineDepth++;
+        mdt.push_back(substituteFormals(line));
+    }
+
+    // Body of macro m with the actual arguments substituted; cached so an
+    // identical invocation is not re-expanded
+    vector<string> &expandMacro(int m, vector<string> &args)
+    {
+        string key = to_string(m);
+        for (string &a : args)
+            key += "\x1f" + a;
+        expansionCount++;
+
+        auto cached = expansionCache.find(key);
+        if (cached != expansionCache.end())
+        {
+            cacheHits++;
+            return cached->second;
+        }
+
+        vector<string> &lines = expansionCache[key];
+        // Nested MACRO ... MEND blocks are part of the body and are
+        // replayed as-is; only the macro's own MEND ends it
+        for (int i = mnt[m].mdtIndex; i < mnt[m].mdtEnd && i < (int)mdt.size(); i++)
+        {
+            string line = mdt[i];
+            size_t pos = 0;
+            while ((pos = line.find("(P,", pos)) != string::npos)
+            {
+                size_t close = line.find(')', pos);
+                string index = line.substr(pos + 3, close - pos - 3);
+                if (close == string::npos || index.empty() ||
+                    index.find_first_not_of("0123456789") != string::npos)
+                    break;
+                int k = stoi(index);
+                string actual = k >= 1 && k <= (int)args.size() ? args[k - 1] : "";
+                line.replace(pos, close - pos + 1, actual);
+                pos += actual.length();
+            }
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    // Entry point for every source line: handles macro definitions and
+    // calls, and streams everything else (including expanded lines) on to
+    // the assembler. `out` is null in one-pass mode.
+    void feedLine(string line, ofstream *out)
+    {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back(); // CRLF sources
+        stringstream ss(line);
+        string first, second;
+        ss >> first;
+
+        if (defineDepth > 0)
+        {
+            defineLine(line);
+            return;
+        }
+        if (first == "MACRO")
+        {
+            defineDepth = 1;
+            expectPrototype = true;
+            return;
+        }
+
+        // Macro call, optionally labelled: [LABEL] NAME arg1, arg2, ...
+        string label;
+        int m = findMacro(first);
+        if (m == -1 && !first.empty() && !isOpcode(first))
+        {
+            ss >> second;
+            m = findMacro(second);
+            label = first;
+        }
+        if (m == -1)
+        {
+            if (out)
+                processLine(line, *out);
+            else
+                processLineOnePass(line);
+            return;
+        }
+
+        string rest, arg;
+        getline(ss, rest);
+        for (char &c : rest)
+            if (c == ',')
+                c = ' ';
+        stringstream as(rest);
+        vector<string> args;
+        while (as >> arg)
+            args.push_back(arg);
+        if ((int)args.size() != mnt[m].paramCount)
+            cout << "Error: Macro " << mnt[m].name << " expects " << mnt[m].paramCount
+                 << " arguments, got " << args.size() << endl;
+
+        vector<string> &lines = expandMacro(m, args); // map entries stay put
+        for (size_t i = 0; i < lines.size(); i++)
+        {
+            // The call's label goes on the first expanded line
+            feedLine(i == 0 && !label.empty() ? label + " " + lines[i] : lines[i], out);
         }
     }
 
@@ -428,7 +899,7 @@ public:
         }
         out << "=== SYMBOL TABLE ===\n";
         out << "Index\tName\tAddress\n";
-        for (int i = 0; i < symCount; i++)
+        for (int i = 0; i < (int)symtab.size(); i++)
             out << i << "\t" << symtab[i].name << "\t" << symtab[i].address << "\n";
         out.close();
         cout << "Symbol table written to " << filename << endl;
@@ -444,7 +915,7 @@ public:
         }
         out << "=== LITERAL TABLE ===\n";
         out << "Index\tName\tAddress\n";
-        for (int i = 0; i < litCount; i++)
+        for (int i = 0; i < (int)littab.size(); i++)
             out << i << "\t" << littab[i].name << "\t" << littab[i].address << "\n";
         out.close();
         cout << "Literal table written to " << filename << endl;
@@ -460,11 +931,42 @@ public:
         }
         out << "=== POOL TABLE ===\n";
         out << "Pool#\tStartIndex\n";
-        for (int i = 0; i < poolCount; i++)
+        for (int i = 0; i < (int)pooltab.size(); i++)
             out << i << "\t" << pooltab[i] << "\n";
         out.close();
         cout << "Pool table written to " << filename << endl;
     }
+
+    void displayMacroTables(string mntFile, string mdtFile)
+    {
+        if (mnt.empty())
+            return;
+        ofstream out(mntFile);
+        if (!out)
+        {
+            cerr << "Error: Cannot open file " << mntFile << endl;
+            return;
+        }
+        out << "=== MACRO NAME TABLE ===\n";
+        out << "Index\tName\tMDT\tParams\n";
+        for (size_t i = 0; i < mnt.size(); i++)
+            out << i << "\t" << mnt[i].name << "\t" << mnt[i].mdtIndex << "\t" << mnt[i].paramCount << "\n";
+        out.close();
+
+        out.open(mdtFile);
+        if (!out)
+        {
+            cerr << "Error: Cannot open file " << mdtFile << endl;
+            return;
+        }
+        out << "=== MACRO DEFINITION TABLE ===\n";
+        out << "Index\tLine\n";
+        for (size_t i = 0; i < mdt.size(); i++)
+            out << i << "\t" << mdt[i] << "\n";
+        out.close();
+        cout << "Macro tables written to " << mntFile << " and " << mdtFile << endl;
+        cout << "Macro expansions: " << expansionCount << " (" << cacheHits << " from cache)" << endl;
+    }
     // --- Main Assembly Process ---
     void assemble(string inputFile)
     {
@@ -486,7 +988,7 @@ public:
         string line;
         while (getline(in, line))
         {
-            processLine(line, out);
+            feedLine(line, &out);
         }
 
         in.close();
@@ -496,15 +998,65 @@ public:
         displaySymbolTable("sym_table.txt");
         displayLiteralTable("lit_table.txt");
         displayPoolTable("pool_table.txt");
+        displayMacroTables("mnt_table.txt", "mdt_table.txt");
 
         cout << "Pass-1 completed." << endl;
     }
+
+    // --- Single-Pass Assembly ---
+    // Reads the source once and writes final machine code; no
+    // intermediate file and no second walk over the source
+    void assembleOnePass(string inputFile)
+    {
+        ifstream in(inputFile);
+        if (!in)
+        {
+            cerr << "Error: Cannot open input file " << inputFile << endl;
+            return;
+        }
+
+        cout << "Starting one-pass assembly..." << endl;
+        string line;
+        while (getline(in, line))
+        {
+            feedLine(line, nullptr);
+        }
+        in.close();
+
+        for (int i = 0; i < (int)symtab.size(); i++)
+            if (symtab[i].address == -1)
+                cout << "Error: Symbol not defined - " << symtab[i].name << endl;
+
+        ofstream out("machine_code.txt");
+        if (!out)
+        {
+            cerr << "Error: Cannot create machine_code.txt" << endl;
+            return;
+        }
+        for (size_t i = 0; i < code.size(); i++)
+            out << code[i].lc << ") " << code[i].opcode << " " << code[i].reg << " " << code[i].address << "\n";
+        out.close();
+        cout << "Machine code written to machine_code.txt" << endl;
+
+        displaySymbolTable("sym_table.txt");
+        displayLiteralTable("lit_table.txt");
+        displayPoolTable("pool_table.txt");
+        displayMacroTables("mnt_table.txt", "mdt_table.txt");
+
+        cout << "One-pass assembly completed." << endl;
+    }
 };
 
 // --- Main Function ---
-int main()
+// Usage: ele [--one-pass] [input file]
+int main(int argc, char *argv[])
 {
     AssemblerPass1 a;
-    a.assemble("input.asm");
+    bool onePass = argc > 1 && string(argv[1]) == "--one-pass";
+    string input = argc > (onePass ? 2 : 1) ? argv[onePass ? 2 : 1] : "input.asm";
+    if (onePass)
+        a.assembleOnePass(input);
+    else
+        a.assemble(input);
     return 0;
 }
\ No newline at end of file
@@ -1,13 +1,242 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
-#include <unistd.h> // for sleep()
+#include <string>
+#include <random>
+#include <chrono>
+#include <fstream>
+#include <cstdint>
+#include <thread>
+#include <unistd.h>       // for sleep()
+#include <sys/resource.h> // for getrusage()
 using namespace std;
 
+// --- Counters collected for a single election run ---
+struct ElectionStats
+{
+    long messages = 0; // ELECTION, OK, COORDINATOR and lost messages
+    long hops = 0;     // message delays on the critical path
+    int restarts = 0;  // elections restarted after a cascaded crash
+    long naive = 0;    // messages if every initiator ran its own election
+    long suppressed = 0; // redundant messages eliminated (naive - messages)
+    int denied = 0;    // elections refused by the lease or rate limit
+};
+
+// --- Ring election token ---
+// Carries only the running maximum; the participant bitset (indexed by
+// position in the sorted process list) is filled only when tracking is on.
+struct RingToken
+{
+    int maxId = -1;
+    long count = 0;
+    size_t at = 0; // ring position, used when several tokens are in flight
+    vector<bool> participants;
+
+    void visit(int id, size_t pos)
+    {
+        maxId = max(maxId, id);
+        count++;
+        if (!participants.empty())
+            participants[pos] = true;
+    }
+};
+
+// --- Election event tracing ---
+// Fixed-size binary ring buffer of timestamped events; once full, the
+// oldest events are overwritten. Recording never allocates, so an
+// enabled trace costs one clock read and a 24-byte store per event.
+enum TraceKind : uint8_t
+{
+    EV_SEND,
+    EV_RECV,
+    EV_TIMEOUT,
+    EV_ELECT,
+    EV_PHASE_BEGIN,
+    EV_PHASE_END
+};
+
+enum TracePhase : uint8_t
+{
+    PH_TOTAL,
+    PH_ELECTION,    // ELECTION/OK exchange or token circulation
+    PH_COORDINATOR, // COORDINATOR broadcast
+    PH_COUNT
+};
+
+struct TraceEvent
+{
+    uint64_t ns; // since the recorder was created
+    int32_t from;
+    int32_t to;
+    uint8_t kind;
+    uint8_t phase;
+};
+
+class TraceRecorder
+{
+    static const int BUCKETS = 64; // log2(ns) latency buckets
+
+    vector<TraceEvent> events;
+    size_t mask;
+    size_t head = 0; // total events ever recorded
+    chrono::steady_clock::time_point origin = chrono::steady_clock::now();
+    uint64_t phaseStart[PH_COUNT] = {};
+    uint64_t histogram[PH_COUNT][BUCKETS] = {};
+
+    uint64_t nowNs()
+    {
+        return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - origin).count();
+    }
+
+    static int bucketOf(uint64_t ns)
+    {
+        int b = 0;
+        while (ns >>= 1)
+            b++;
+        return b;
+    }
+
+public:
+    // Capacity is rounded up to a power of two
+    explicit TraceRecorder(size_t capacity)
+    {
+        size_t cap = 1;
+        while (cap < capacity)
+            cap <<= 1;
+        events.resize(cap);
+        mask = cap - 1;
+    }
+
+    void record(TraceKind kind, int from, int to, TracePhase phase = PH_TOTAL)
+    {
+        TraceEvent &e = events[head++ & mask];
+        e.ns = nowNs();
+        e.from = from;
+        e.to = to;
+        e.kind = kind;
+        e.phase = phase;
+    }
+
+    void beginPhase(TracePhase phase, int pid)
+    {
+        record(EV_PHASE_BEGIN, pid, pid, phase);
+        phaseStart[phase] = events[(head - 1) & mask].ns;
+    }
+
+    void endPhase(TracePhase phase, int pid)
+    {
+        record(EV_PHASE_END, pid, pid, phase);
+        histogram[phase][bucketOf(events[(head - 1) & mask].ns - phaseStart[phase])]++;
+    }
+
+    size_t size() { return min(head, events.size()); }
+
+    // Chrome trace JSON (chrome://tracing, Perfetto); one track per process
+    void exportChrome(ostream &out)
+    {
+        static const char *kindName[] = {"send", "recv", "timeout", "elect"};
+        static const char *phaseName[] = {"election-total", "election", "coordinator"};
+
+        out << "{\"traceEvents\":[\n";
+        size_t first = head - size();
+        for (size_t i = first; i < head; i++)
+        {
+            const TraceEvent &e = events[i & mask];
+            out << (i == first ? "" : ",\n");
+            out << "{\"pid\":0,\"tid\":" << e.from << ",\"ts\":" << e.ns / 1000.0;
+            if (e.kind == EV_PHASE_BEGIN || e.kind == EV_PHASE_END)
+                out << ",\"ph\":\"" << (e.kind == EV_PHASE_BEGIN ? 'B' : 'E')
+                    << "\",\"name\":\"" << phaseName[e.phase] << "\"}";
+            else
+                out << ",\"ph\":\"i\",\"s\":\"t\",\"name\":\"" << kindName[e.kind]
+                    << "\",\"args\":{\"to\":" << e.to << "}}";
+        }
+        out << "\n]}\n";
+    }
+
+    // Bucket upper bound (ns) below which `pct` percent of samples fall
+    uint64_t percentile(TracePhase phase, double pct)
+    {
+        uint64_t total = 0;
+        for (int b = 0; b < BUCKETS; b++)
+            total += histogram[phase][b];
+        uint64_t seen = 0;
+        for (int b = 0; b < BUCKETS; b++)
+        {
+            seen += histogram[phase][b];
+            if (total && seen * 100.0 >= pct * total)
+                return 2ULL << b;
+        }
+        return 0;
+    }
+
+    void printHistograms(ostream &out)
+    {
+        static const char *phaseName[] = {"total", "election", "coordinator"};
+        out << "phase,bucket_le_ns,count\n";
+        for (int p = 0; p < PH_COUNT; p++)
+            for (int b = 0; b < BUCKETS; b++)
+                if (histogram[p][b])
+                    out << phaseName[p] << "," << (2ULL << b) << "," << histogram[p][b] << "\n";
+        out << "phase,p50_ns,p99_ns\n";
+        for (int p = 0; p < PH_COUNT; p++)
+            out << phaseName[p] << "," << percentile((TracePhase)p, 50) << ","
+                << percentile((TracePhase)p, 99) << "\n";
+    }
+};
+
 class Election
 {
     vector<int> processes;
     int coordinator;
+    bool verbose = true;           // print and sleep between steps (interactive mode)
+    bool trackParticipants = true; // keep the ring participant bitset
+    TraceRecorder *trace = nullptr; // event recorder, off unless attached
+
+    // --- Term and lease state (simulated clock, milliseconds) ---
+    long term = 0;              // bumped by every completed election
+    long now = 0;               // advanced with tick()
+    long leaseUntil = 0;        // followers trust the coordinator until then
+    long lastElection = -1;     // time of the last completed election
+    long leaseMs = 0;           // 0 disables leases
+    long minElectionGapMs = 0;  // rate limit between elections
+
+    // --- Hierarchical state ---
+    // tree[0] is the process list (-1 once down); tree[L + 1][g] is the
+    // leader elected by group g of tree[L], i.e. members g*fanout ...
+    vector<vector<int>> tree;
+    size_t fanout = 0;
+    long treeLive = 0; // live entries of tree[0]
+
+    void beginTerm(int newCoordinator)
+    {
+        coordinator = newCoordinator;
+        term++;
+        lastElection = now;
+        leaseUntil = now + leaseMs;
+    }
+
+    void pause()
+    {
+        if (verbose)
+            sleep(1);
+    }
+
+    // Sorted list of processes minus the crashed ones
+    vector<int> aliveWithout(vector<int> crashed)
+    {
+        sort(crashed.begin(), crashed.end());
+        vector<int> alive;
+        alive.reserve(processes.size());
+        set_difference(processes.begin(), processes.end(),
+                       crashed.begin(), crashed.end(), back_inserter(alive));
+        return alive;
+    }
+
+    static bool contains(const vector<int> &sorted, int id)
+    {
+        return binary_search(sorted.begin(), sorted.end(), id);
+    }
 
 public:
     void input()
@@ -25,64 +254,486 @@ public:
         cout << "\nInitial Coordinator: Process " << coordinator << "\n";
     }
 
-    void bully()
+    // Non-interactive setup used by the benchmark harness
+    void load(const vector<int> &ids)
     {
-        int crash, initiator;
-        cout << "The cordinator process :" << coordinator << "Crashed" << endl;
-        crash = coordinator;
-        cout << "Enter election initiator process ID: ";
-        cin >> initiator;
+        processes = ids;
+        sort(processes.begin(), processes.end());
+        coordinator = processes.back();
+        term = now = leaseUntil = 0;
+        lastElection = -1;
+        tree.clear(); // built for the old process list
+        fanout = 0;
+        treeLive = 0;
+    }
+
+    void setVerbose(bool v) { verbose = v; }
+    void setLease(long lease, long minGap)
+    {
+        leaseMs = lease;
+        minElectionGapMs = minGap;
+    }
+    void tick(long ms) { now += ms; }
+    long getTerm() { return term; }
+
+    // Coordinator heartbeat: extends the lease for the current term
+    void renewLease() { leaseUntil = now + leaseMs; }
 
-        if (find(processes.begin(), processes.end(), initiator) == processes.end())
+    // Followers may answer reads locally while the lease holds
+    bool leaseValid() { return now < leaseUntil; }
+
+    // A new election may start only once the current lease has run out
+    // (a live coordinator keeps renewing it, so a recovered higher process
+    // simply rejoins as a follower) and the rate limit has passed.
+    bool mayElect()
+    {
+        if (leaseValid())
+            return false;
+        return lastElection < 0 || now - lastElection >= minElectionGapMs;
+    }
+
+    // Checked by every run*: a refused election leaves the term as it is
+    // and is counted in st.denied
+    bool admitElection(ElectionStats &st)
+    {
+        if (mayElect())
+            return true;
+        st.denied++;
+        return false;
+    }
+
+    void reportRefusal()
+    {
+        cout << "Election refused, term " << term << " stays with Process " << coordinator << ": "
+             << (leaseValid() ? "its lease is still valid" : "too soon after the last election") << "\n";
+    }
+    void setTrackParticipants(bool t) { trackParticipants = t; }
+    void setTrace(TraceRecorder *t) { trace = t; }
+    int getCoordinator() { return coordinator; }
+    size_t hierarchyDepth() { return tree.empty() ? 0 : tree.size() - 1; }
+
+    // --- Bully election ---
+    // `crashed` are down before the election starts; the IDs in `cascade`
+    // crash in order right after answering OK. Losing the would-be
+    // coordinator makes the initiator time out and restart, and the
+    // remaining IDs crash during the restarted rounds.
+    // Returns the new coordinator, or -1 for an invalid initiator or a
+    // refused election.
+    int runBully(int initiator, const vector<int> &crashed, const vector<int> &cascade, ElectionStats &st)
+    {
+        vector<int> alive = aliveWithout(crashed);
+        if (!contains(alive, initiator))
         {
-            cout << "Invalid initiator!\n";
-            return;
+            if (verbose)
+                cout << "Invalid initiator!\n";
+            return -1;
         }
+        if (!admitElection(st))
+            return -1;
 
-        vector<int> alive;
-        for (int p : processes)
-            if (p != crash)
-                alive.push_back(p);
+        if (verbose)
+        {
+            cout << "\n--- Bully Algorithm Simulation ---\n";
+            cout << "Process " << initiator << " notices that coordinator (Process " << coordinator << ") has crashed.\n";
+        }
+        pause();
 
-        cout << "\n--- Bully Algorithm Simulation ---\n";
-        cout << "Process " << initiator << " notices that coordinator (Process " << crash << ") has crashed.\n";
-        sleep(1);
+        if (trace)
+        {
+            trace->beginPhase(PH_TOTAL, initiator);
+            trace->beginPhase(PH_ELECTION, initiator);
+        }
 
-        cout << "\nProcess " << initiator << " sends ELECTION messages to all higher processes:\n";
-        bool foundHigher = false;
-        for (int p : alive)
+        size_t nextCrash = 0;
+        int newCoordinator;
+        while (true)
         {
-            if (p > initiator)
+            auto firstHigher = upper_bound(alive.begin(), alive.end(), initiator);
+            long higher = alive.end() - firstHigher;
+            if (trace)
             {
-                cout << " → Sent to Process " << p << "\n";
-                sleep(1);
-                foundHigher = true;
+                for (auto it = firstHigher; it != alive.end(); ++it)
+                    trace->record(EV_SEND, initiator, *it, PH_ELECTION);
+                for (auto it = firstHigher; it != alive.end(); ++it)
+                    trace->record(EV_RECV, *it, initiator, PH_ELECTION);
             }
+
+            if (higher == 0)
+            {
+                if (verbose)
+                    cout << "No higher process found. Process " << initiator << " becomes new Coordinator!\n";
+                newCoordinator = initiator;
+                break;
+            }
+
+            if (verbose)
+            {
+                cout << "\nProcess " << initiator << " sends ELECTION messages to all higher processes:\n";
+                for (auto it = firstHigher; it != alive.end(); ++it)
+                {
+                    cout << " → Sent to Process " << *it << "\n";
+                    pause();
+                }
+                cout << "\nHigher processes respond with OK messages...\n";
+            }
+            pause();
+            st.messages += 2 * higher; // ELECTION out, OK back
+            st.hops += 2;
+
+            newCoordinator = alive.back(); // highest alive process
+
+            // Cascaded crashes: victims go down after their OK until the
+            // would-be coordinator is among them; the rest wait for the
+            // restarted round
+            bool lostCoordinator = false;
+            while (nextCrash < cascade.size() && !lostCoordinator)
+            {
+                int victim = cascade[nextCrash++];
+                auto pos = lower_bound(alive.begin(), alive.end(), victim);
+                if (pos == alive.end() || *pos != victim || victim == initiator)
+                    continue;
+                alive.erase(pos);
+                if (verbose)
+                    cout << "Process " << victim << " crashed during the election!\n";
+                lostCoordinator = victim == newCoordinator;
+            }
+            if (lostCoordinator)
+            {
+                if (verbose)
+                    cout << "Process " << initiator << " times out waiting for COORDINATOR and restarts.\n";
+                if (trace)
+                    trace->record(EV_TIMEOUT, initiator, newCoordinator, PH_ELECTION);
+                st.hops++; // timeout
+                st.restarts++;
+                continue;
+            }
+            break;
         }
 
-        if (!foundHigher)
+        if (trace)
         {
-            cout << "No higher process found. Process " << initiator << " becomes new Coordinator!\n";
-            coordinator = initiator;
-            return;
+            trace->endPhase(PH_ELECTION, initiator);
+            trace->record(EV_ELECT, newCoordinator, newCoordinator);
+            trace->beginPhase(PH_COORDINATOR, newCoordinator);
+            for (int p : alive)
+                if (p != newCoordinator)
+                    trace->record(EV_SEND, newCoordinator, p, PH_COORDINATOR);
+            trace->endPhase(PH_COORDINATOR, newCoordinator);
+            trace->endPhase(PH_TOTAL, initiator);
         }
 
-        cout << "\nHigher processes respond with OK messages...\n";
-        sleep(1);
+        if (verbose)
+        {
+            cout << "\nProcess " << newCoordinator << " has the highest ID.\n";
+            pause();
+            cout << "Process " << newCoordinator << " becomes the new Coordinator!\n";
+            pause();
 
-        int newCoordinator = alive.back(); // highest alive process
-        cout << "\nProcess " << newCoordinator << " has the highest ID.\n";
-        sleep(1);
-        cout << "Process " << newCoordinator << " becomes the new Coordinator!\n";
-        sleep(1);
+            cout << "\nCoordinator message sent to all other processes...\n";
+            for (int p : alive)
+                if (p != newCoordinator)
+                    cout << " → Process " << p << " acknowledges new Coordinator " << newCoordinator << "\n";
+        }
+        st.messages += alive.size() - 1;
+        st.hops++;
 
-        cout << "\nCoordinator message sent to all other processes...\n";
-        for (int p : alive)
-            if (p != newCoordinator)
-                cout << " → Process " << p << " acknowledges new Coordinator " << newCoordinator << "\n";
+        beginTerm(newCoordinator);
+        if (verbose)
+            cout << "\nElection Complete. New Coordinator: Process " << coordinator << " (term " << term << ")\n";
+        return coordinator;
+    }
 
-        coordinator = newCoordinator;
-        cout << "\nElection Complete. New Coordinator: Process " << coordinator << "\n";
+    // --- Ring election ---
+    // The token only carries the running maximum, so each hop is O(1) and
+    // the ring is walked in place over `processes`. Processes in `cascade`
+    // crash as soon as the election starts; the token is lost at each of
+    // them and the sender times out and skips ahead.
+    int runRing(int initiator, const vector<int> &crashed, const vector<int> &cascade, ElectionStats &st)
+    {
+        vector<int> dead = crashed;
+        sort(dead.begin(), dead.end());
+        auto self = lower_bound(processes.begin(), processes.end(), initiator);
+        if (self == processes.end() || *self != initiator || contains(dead, initiator))
+        {
+            if (verbose)
+                cout << "Invalid initiator!\n";
+            return -1;
+        }
+        if (!admitElection(st))
+            return -1;
+        vector<int> down = cascade;
+        sort(down.begin(), down.end());
+        down.erase(remove(down.begin(), down.end(), initiator), down.end());
+
+        size_t n = processes.size();
+        size_t start = self - processes.begin();
+        RingToken token;
+        if (trackParticipants)
+            token.participants.assign(n, false);
+
+        if (verbose)
+        {
+            cout << "\n--- Ring Algorithm Simulation ---\n";
+            cout << "Process " << initiator << " starts election.\n";
+        }
+        pause();
+
+        if (trace)
+        {
+            trace->beginPhase(PH_TOTAL, initiator);
+            trace->beginPhase(PH_ELECTION, initiator);
+        }
+
+        size_t current = start;
+        for (size_t i = 1; i <= n; i++)
+        {
+            size_t next = (start + i) % n;
+            int nextId = processes[next];
+            if (!dead.empty() && contains(dead, nextId))
+                continue; // already known to be down, not part of the ring
+            if (!down.empty() && contains(down, nextId))
+            {
+                if (verbose)
+                    cout << "Process " << nextId << " is down, Process " << processes[current] << " skips it.\n";
+                st.messages++; // lost message
+                st.hops += 2;  // send + timeout
+                if (trace)
+                    trace->record(EV_TIMEOUT, processes[current], nextId, PH_ELECTION);
+                continue;
+            }
+            token.visit(processes[current], current);
+            if (trace)
+            {
+                trace->record(EV_SEND, processes[current], nextId, PH_ELECTION);
+                trace->record(EV_RECV, nextId, processes[current], PH_ELECTION);
+            }
+            if (verbose)
+                cout << "Process " << processes[current] << " passes election message to Process " << nextId
+                     << " [ max " << token.maxId << " ]\n";
+            pause();
+            st.messages++;
+            st.hops++;
+            current = next;
+        }
+
+        if (verbose)
+        {
+            cout << "\nMessage returns to initiator. Election message complete.\n";
+            if (trackParticipants)
+            {
+                cout << "Participants: [";
+                for (size_t p = 0; p < n; p++)
+                    if (token.participants[p])
+                        cout << " " << processes[p];
+                cout << " ]\n";
+            }
+        }
+        pause();
+
+        int newCoordinator = token.maxId;
+        if (trace)
+        {
+            trace->endPhase(PH_ELECTION, initiator);
+            trace->record(EV_ELECT, newCoordinator, newCoordinator);
+            trace->beginPhase(PH_COORDINATOR, newCoordinator);
+            for (size_t i = 1; i <= n; i++)
+            {
+                int p = processes[(start + i) % n];
+                if (!contains(dead, p) && !contains(down, p))
+                    trace->record(EV_RECV, p, newCoordinator, PH_COORDINATOR);
+            }
+            trace->endPhase(PH_COORDINATOR, newCoordinator);
+            trace->endPhase(PH_TOTAL, initiator);
+        }
+        if (verbose)
+            cout << "Highest ID = Process " << newCoordinator << " → New Coordinator!\n";
+        pause();
+
+        if (verbose)
+        {
+            cout << "\nCoordinator message circulating in ring...\n";
+            for (int p : processes)
+                if (p != newCoordinator && !contains(dead, p) && !contains(down, p))
+                    cout << " → Process " << p << " acknowledges Coordinator " << newCoordinator << "\n";
+        }
+        st.messages += token.count;
+        st.hops += token.count;
+
+        beginTerm(newCoordinator);
+        if (verbose)
+            cout << "\nElection Complete. New Coordinator: Process " << coordinator << " (term " << term << ")\n";
+        return coordinator;
+    }
+
+    // --- Concurrent bully election ---
+    // All `initiators` notice the crash at once; `rng` fixes the order in
+    // which their ELECTION messages arrive so a run can be replayed.
+    // A process that has already received ELECTION is taking part, so
+    // its own election and any ELECTION aimed at it again are suppressed;
+    // a late initiator with nothing new above it needs one ELECTION/OK
+    // exchange to stand down. Only one COORDINATOR broadcast goes out.
+    int runBullyConcurrent(vector<int> initiators, const vector<int> &crashed, mt19937 &rng, ElectionStats &st)
+    {
+        vector<int> alive = aliveWithout(crashed);
+        sort(initiators.begin(), initiators.end());
+        initiators.erase(unique(initiators.begin(), initiators.end()), initiators.end());
+        initiators.erase(remove_if(initiators.begin(), initiators.end(),
+                                   [&](int id) { return !contains(alive, id); }),
+                         initiators.end());
+        if (initiators.empty())
+        {
+            if (verbose)
+                cout << "No valid initiator!\n";
+            return -1;
+        }
+        if (!admitElection(st))
+            return -1;
+        shuffle(initiators.begin(), initiators.end(), rng);
+
+        long n = alive.size();
+        long notified = n; // alive[notified..] have received ELECTION
+        for (int x : initiators)
+        {
+            long idx = lower_bound(alive.begin(), alive.end(), x) - alive.begin();
+            long higher = n - idx - 1;
+            st.naive += 2 * higher + (n - 1);
+
+            if (idx >= notified)
+            {
+                if (verbose)
+                    cout << "Process " << x << " is already in the election, its own is suppressed.\n";
+                continue;
+            }
+            long fresh = notified - idx - 1;
+            if (verbose)
+                cout << "Process " << x << " sends ELECTION to " << fresh << " new higher process(es).\n";
+            if (fresh == 0 && notified < n)
+                fresh = 1; // one exchange with a process already electing
+            st.messages += 2 * fresh;
+            notified = idx + 1;
+        }
+
+        int newCoordinator = alive.back();
+        st.messages += n - 1;
+        bool selfElected = find(initiators.begin(), initiators.end(), newCoordinator) != initiators.end();
+        st.hops += selfElected ? 1 : 3; // ELECTION, OK, COORDINATOR
+        st.suppressed = st.naive - st.messages;
+
+        beginTerm(newCoordinator);
+        if (verbose)
+            cout << "\nElection Complete. New Coordinator: Process " << coordinator
+                 << " (" << st.suppressed << " redundant messages suppressed)\n";
+        return coordinator;
+    }
+
+    // --- Concurrent ring election (Chang-Roberts) ---
+    // Every initiator launches a running-maximum token; `rng` picks which
+    // in-flight token moves next. A participant that receives a token whose
+    // maximum is below its own ID swallows it, so only the token carrying
+    // the highest ID completes the circle.
+    int runRingConcurrent(vector<int> initiators, const vector<int> &crashed, mt19937 &rng, ElectionStats &st)
+    {
+        vector<int> dead = crashed;
+        sort(dead.begin(), dead.end());
+        size_t n = processes.size();
+        long aliveCount = 0;
+        for (int p : processes)
+            if (!contains(dead, p))
+                aliveCount++;
+
+        vector<char> participant(n, 0);
+        vector<RingToken> inFlight;
+        for (int x : initiators)
+        {
+            auto self = lower_bound(processes.begin(), processes.end(), x);
+            if (self == processes.end() || *self != x || contains(dead, x))
+                continue;
+            size_t pos = self - processes.begin();
+            if (participant[pos])
+                continue; // same initiator listed twice
+            participant[pos] = 1;
+            RingToken t;
+            t.maxId = x;
+            t.at = pos;
+            inFlight.push_back(t);
+        }
+        if (inFlight.empty())
+        {
+            if (verbose)
+                cout << "No valid initiator!\n";
+            return -1;
+        }
+        if (!admitElection(st))
+            return -1;
+        // Alone, a token travels up to the highest process, which then
+        // circulates its own token and the COORDINATOR message
+        for (const RingToken &t : inFlight)
+        {
+            long higher = n - t.at - 1;
+            for (int d : dead)
+                if (d > t.maxId)
+                    higher--;
+            st.naive += higher + aliveCount + aliveCount - 1;
+        }
+
+        int newCoordinator = -1;
+        long winnerHops = 0;
+        while (!inFlight.empty())
+        {
+            size_t k = rng() % inFlight.size();
+            RingToken &t = inFlight[k];
+            do
+                t.at = (t.at + 1) % n;
+            while (!dead.empty() && contains(dead, processes[t.at]));
+            st.messages++;
+            t.count++;
+
+            int id = processes[t.at];
+            bool drop = false;
+            if (id == t.maxId)
+            {
+                newCoordinator = id; // token came back to its owner
+                winnerHops = t.count;
+                drop = true;
+            }
+            else if (id > t.maxId)
+            {
+                if (participant[t.at])
+                    drop = true; // a larger candidate is already circulating
+                else
+                    t.maxId = id;
+            }
+            participant[t.at] = 1;
+
+            if (drop)
+            {
+                inFlight[k] = inFlight.back();
+                inFlight.pop_back();
+            }
+        }
+
+        st.messages += aliveCount - 1; // COORDINATOR circulation
+        st.hops += winnerHops + aliveCount - 1;
+        st.suppressed = st.naive - st.messages;
+
+        beginTerm(newCoordinator);
+        if (verbose)
+            cout << "\nElection Complete. New Coordinator: Process " << coordinator
+                 << " (" << st.suppressed << " redundant messages suppressed)\n";
+        return coordinator;
+    }
+
+    void bully()
+    {
+        int crash, initiator;
+        cout << "The cordinator process :" << coordinator << "Crashed" << endl;
+        crash = coordinator;
+        cout << "Enter election initiator process ID: ";
+        cin >> initiator;
+
+        ElectionStats st;
+        if (runBully(initiator, {crash}, {}, st) == -1 && st.denied)
+            reportRefusal();
     }
 
     void ring()
@@ -93,59 +744,535 @@ public:
         cout << "The cordinator process :" << coordinator << "Crashed" << endl;
         crash = coordinator;
 
-        vector<int> alive;
-        for (int p : processes)
-            if (p != crash)
-                alive.push_back(p);
+        ElectionStats st;
+        if (runRing(initiator, {crash}, {}, st) == -1 && st.denied)
+            reportRefusal();
+    }
 
-        if (find(alive.begin(), alive.end(), initiator) == alive.end())
+    // --- Hierarchical election ---
+    // Local bully inside one group of tree[level]: the lowest live member
+    // starts it, so 2(k-1) ELECTION/OK plus k-1 COORDINATOR messages for
+    // k live members. Stores and returns the leader (-1 if none is alive).
+    int electGroup(size_t level, size_t g, long &messages)
+    {
+        const vector<int> &members = tree[level];
+        size_t end = min(members.size(), (g + 1) * fanout);
+        int leader = -1;
+        long live = 0;
+        for (size_t i = g * fanout; i < end; i++)
         {
-            cout << "Invalid initiator!\n";
-            return;
+            if (members[i] != -1)
+            {
+                live++;
+                leader = max(leader, members[i]);
+            }
         }
+        if (live > 1)
+            messages += 3 * (live - 1);
+        tree[level + 1][g] = leader;
+        return leader;
+    }
 
-        cout << "\n--- Ring Algorithm Simulation ---\n";
-        int start = find(alive.begin(), alive.end(), initiator) - alive.begin();
-        vector<int> message;
-        cout << "Process " << initiator << " starts election.\n";
-        sleep(1);
+    // The root's COORDINATOR is relayed down the tree by the group
+    // leaders: one message per other live process, one hop per level
+    void announceRoot(ElectionStats &st)
+    {
+        st.messages += treeLive - 1;
+        st.hops += hierarchyDepth();
+    }
 
-        for (int i = 0; i < alive.size(); i++)
+    // Partitions the processes into groups of `f`, elects all groups of a
+    // level in parallel on `workers` threads, then repeats on the leaders
+    // until one global coordinator remains.
+    int runHierarchical(int f, const vector<int> &crashed, int workers, ElectionStats &st)
+    {
+        if (processes.empty())
         {
-            int current = alive[(start + i) % alive.size()];
-            int next = alive[(start + i + 1) % alive.size()];
-            message.push_back(current);
-            cout << "Process " << current << " passes election message to Process " << next << " [";
-            for (int id : message)
-                cout << " " << id;
-            cout << " ]\n";
-            sleep(1);
+            if (verbose)
+                cout << "No processes!\n";
+            return -1;
+        }
+        if (!admitElection(st))
+            return -1;
+        fanout = max(f, 2);
+        vector<int> dead = crashed;
+        sort(dead.begin(), dead.end());
+        tree.assign(1, processes);
+        treeLive = 0;
+        for (int &p : tree[0])
+        {
+            if (contains(dead, p))
+                p = -1;
+            else
+                treeLive++;
         }
 
-        cout << "\nMessage returns to initiator. Election message complete.\n";
-        sleep(1);
+        while (tree.back().size() > 1)
+        {
+            size_t level = tree.size() - 1;
+            size_t groups = (tree[level].size() + fanout - 1) / fanout;
+            tree.emplace_back(groups, -1);
 
-        int newCoordinator = *max_element(message.begin(), message.end());
-        cout << "Highest ID = Process " << newCoordinator << " → New Coordinator!\n";
-        sleep(1);
+            int threads = max(1, min<int>(workers, groups));
+            vector<long> messages(threads, 0);
+            vector<thread> pool;
+            for (int w = 0; w < threads; w++)
+            {
+                pool.emplace_back([&, w]()
+                                  {
+                    for (size_t g = w; g < groups; g += threads)
+                        electGroup(level, g, messages[w]); });
+            }
+            for (thread &th : pool)
+                th.join();
+            for (long m : messages)
+                st.messages += m;
+            st.hops += 3; // groups of one level run concurrently
+        }
 
-        cout << "\nCoordinator message circulating in ring...\n";
-        for (int p : alive)
-            if (p != newCoordinator)
-                cout << " → Process " << p << " acknowledges Coordinator " << newCoordinator << "\n";
+        int root = tree.back()[0];
+        if (root == -1)
+        {
+            if (verbose)
+                cout << "No live process left!\n";
+            return -1;
+        }
+        beginTerm(root);
+        announceRoot(st);
+        if (verbose)
+        {
+            for (size_t level = 1; level < tree.size(); level++)
+            {
+                cout << "Level " << level << " leaders:";
+                for (int id : tree[level])
+                    cout << " " << id;
+                cout << "\n";
+            }
+            cout << "\nElection Complete. New Coordinator: Process " << coordinator << " (term " << term << ")\n";
+        }
+        return coordinator;
+    }
 
-        coordinator = newCoordinator;
-        cout << "\nElection Complete. New Coordinator: Process " << coordinator << "\n";
+    // Marks `id` down and re-elects only the groups on its path to the
+    // root that just lost their leader: O(fanout * depth) election
+    // messages, plus the announcement to every live process when the
+    // coordinator itself changed (the same COORDINATOR cost as bully).
+    int crashHierarchical(int id, ElectionStats &st)
+    {
+        auto it = lower_bound(processes.begin(), processes.end(), id);
+        if (tree.empty() || it == processes.end() || *it != id || tree[0][it - processes.begin()] == -1)
+        {
+            if (verbose)
+                cout << "Invalid process!\n";
+            return -1;
+        }
+        size_t pos = it - processes.begin();
+        tree[0][pos] = -1;
+        treeLive--;
+
+        for (size_t level = 0; level + 1 < tree.size(); level++)
+        {
+            size_t g = pos / fanout;
+            if (tree[level + 1][g] != id)
+                break; // a follower left, the rest of the tree is unaffected
+            int after = electGroup(level, g, st.messages);
+            st.hops += 3;
+            if (verbose)
+                cout << "Group " << g << " at level " << level << " re-elects: Process " << after << "\n";
+            pos = g;
+        }
+
+        int root = tree.back()[0];
+        if (root != coordinator)
+        {
+            beginTerm(root);
+            if (root != -1)
+                announceRoot(st);
+        }
+        if (verbose)
+            cout << "\nCoordinator: Process " << coordinator << " (term " << term << ")\n";
+        return coordinator;
+    }
+
+    void hierarchical()
+    {
+        int f;
+        cout << "Enter group fan-out: ";
+        cin >> f;
+        if (f < 2)
+        {
+            cout << "Fan-out must be at least 2!\n";
+            return;
+        }
+        ElectionStats st;
+        if (runHierarchical(f, {}, max(1u, thread::hardware_concurrency()), st) == -1)
+        {
+            if (st.denied)
+                reportRefusal();
+            return;
+        }
+        cout << "Messages: " << st.messages << ", hops: " << st.hops << "\n";
+
+        int crash;
+        cout << "\nEnter process ID to crash (-1 to skip): ";
+        cin >> crash;
+        if (crash == -1)
+            return;
+        ElectionStats re;
+        crashHierarchical(crash, re);
+        cout << "Re-election messages: " << re.messages << ", hops: " << re.hops << "\n";
+    }
+
+    void concurrent()
+    {
+        int k, algo;
+        unsigned seed;
+        cout << "The cordinator process :" << coordinator << "Crashed" << endl;
+        cout << "Enter number of initiators: ";
+        cin >> k;
+        vector<int> initiators(k);
+        cout << "Enter initiator process IDs: ";
+        for (int i = 0; i < k; i++)
+            cin >> initiators[i];
+        cout << "Enter seed: ";
+        cin >> seed;
+        cout << "1. Bully\n2. Ring\nEnter algorithm: ";
+        cin >> algo;
+
+        mt19937 rng(seed);
+        ElectionStats st;
+        int winner = algo == 1 ? runBullyConcurrent(initiators, {coordinator}, rng, st)
+                               : runRingConcurrent(initiators, {coordinator}, rng, st);
+        if (winner == -1 && st.denied)
+            reportRefusal();
+        if (winner != -1)
+            cout << "Messages sent: " << st.messages << " (independent elections would send " << st.naive << ")\n";
     }
 
     void show()
     {
-        cout << "\nCurrent Coordinator: Process " << coordinator << "\n";
+        cout << "\nCurrent Coordinator: Process " << coordinator << " (term " << term << ")\n";
     }
 };
 
-int main()
+// ================= BENCHMARK HARNESS =================
+// Usage: election --bench [maxN] [seed] [crashes] [cascade] [reps]
+// Prints one CSV row per (algorithm, n) to stdout. process_peak_rss_kb
+// is the high-water mark of the whole harness so far (it never goes
+// down and includes the generated ID sets), not the memory of one run.
+
+long peakMemoryKB()
+{
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+#ifdef __APPLE__
+    return ru.ru_maxrss / 1024; // bytes on macOS
+#else
+    return ru.ru_maxrss; // kilobytes on Linux
+#endif
+}
+
+// n unique, sorted IDs spread over [1, 4n]
+vector<int> generateIds(int n, mt19937 &rng)
+{
+    vector<int> ids(n);
+    for (int i = 0; i < n; i++)
+        ids[i] = i * 4 + 1 + rng() % 4;
+    return ids;
+}
+
+void runBenchmark(long maxN, unsigned seed, int crashes, int cascadeCount, int reps)
+{
+    cout << "algorithm,n,crashed,cascade,messages,hops,restarts,time_us,process_peak_rss_kb\n";
+    mt19937 rng(seed);
+
+    for (long n = 10; n <= maxN; n *= 10)
+    {
+        vector<int> ids = generateIds(n, rng);
+        Election e;
+        e.setVerbose(false);
+        e.setTrackParticipants(false);
+
+        // Coordinator plus random others are down before the election
+        vector<int> crashed = {ids.back()};
+        while ((int)crashed.size() < crashes && (long)crashed.size() < n - 2)
+        {
+            int id = ids[rng() % (n - 1)];
+            if (find(crashed.begin(), crashed.end(), id) == crashed.end())
+                crashed.push_back(id);
+        }
+
+        // Cascade victims are the highest survivors, so each one is the
+        // would-be coordinator at the moment it fails. At least one process
+        // must stay up to initiate.
+        long victims = min<long>(cascadeCount, n - crashed.size() - 1);
+        vector<int> cascade;
+        for (long i = n - 2; i >= 0 && (long)cascade.size() < victims; i--)
+            if (find(crashed.begin(), crashed.end(), ids[i]) == crashed.end())
+                cascade.push_back(ids[i]);
+
+        int initiator;
+        do
+            initiator = ids[rng() % n];
+        while (find(crashed.begin(), crashed.end(), initiator) != crashed.end() ||
+               find(cascade.begin(), cascade.end(), initiator) != cascade.end());
+
+        for (int algo = 0; algo < 2; algo++)
+        {
+            ElectionStats st;
+            double us = 0;
+            for (int r = 0; r < reps; r++)
+            {
+                e.load(ids);
+                st = ElectionStats();
+                auto t0 = chrono::steady_clock::now();
+                if (algo == 0)
+                    e.runBully(initiator, crashed, cascade, st);
+                else
+                    e.runRing(initiator, crashed, cascade, st);
+                auto t1 = chrono::steady_clock::now();
+                us += chrono::duration<double, micro>(t1 - t0).count();
+            }
+            us /= reps;
+
+            cout << (algo == 0 ? "bully" : "ring") << "," << n << "," << crashed.size() << ","
+                 << cascade.size() << "," << st.messages << "," << st.hops << "," << st.restarts << ","
+                 << us << "," << peakMemoryKB() << "\n";
+        }
+    }
+}
+
+// Usage: election --concurrent [n] [maxInitiators] [seed]
+// Doubles the number of simultaneous initiators up to maxInitiators on a
+// fixed n-process group and prints one CSV row per (algorithm, k).
+void runConcurrentBenchmark(long n, int maxK, unsigned seed)
 {
+    cout << "algorithm,n,initiators,messages,naive_messages,suppressed,hops,time_us,coordinator\n";
+    mt19937 idRng(seed);
+    vector<int> ids = generateIds(n, idRng);
+    vector<int> crashed = {ids.back()};
+
+    for (int k = 1; k <= maxK && k < n; k *= 2)
+    {
+        for (int algo = 0; algo < 2; algo++)
+        {
+            mt19937 rng(seed + k); // same initiators and interleaving on replay
+            vector<int> initiators;
+            while ((int)initiators.size() < k)
+            {
+                int id = ids[rng() % (n - 1)];
+                if (find(initiators.begin(), initiators.end(), id) == initiators.end())
+                    initiators.push_back(id);
+            }
+
+            Election e;
+            e.setVerbose(false);
+            e.load(ids);
+            ElectionStats st;
+            auto t0 = chrono::steady_clock::now();
+            int winner = algo == 0 ? e.runBullyConcurrent(initiators, crashed, rng, st)
+                                   : e.runRingConcurrent(initiators, crashed, rng, st);
+            auto t1 = chrono::steady_clock::now();
+
+            cout << (algo == 0 ? "bully" : "ring") << "," << n << "," << k << "," << st.messages << ","
+                 << st.naive << "," << st.suppressed << "," << st.hops << ","
+                 << chrono::duration<double, micro>(t1 - t0).count() << "," << winner << "\n";
+        }
+    }
+}
+
+// Usage: election --flap [n] [steps] [seed]
+// Replays the same flapping schedule (coordinator crashes, crashed
+// processes recovering, reads, heartbeats) with and without leases and
+// prints one CSV row per mode.
+void runFlapBenchmark(long n, int steps, unsigned seed)
+{
+    cout << "mode,n,steps,terms,denied,messages,local_reads,remote_reads\n";
+    for (int mode = 0; mode < 2; mode++)
+    {
+        mt19937 rng(seed);
+        vector<int> ids = generateIds(n, rng);
+        Election e;
+        e.setVerbose(false);
+        e.load(ids);
+        if (mode == 1)
+            e.setLease(2000, 1000);
+        e.renewLease();
+
+        vector<int> crashed;
+        bool coordinatorDown = false;
+        long localReads = 0, remoteReads = 0;
+        ElectionStats st;
+        for (int step = 0; step < steps; step++)
+        {
+            e.tick(50 + rng() % 200);
+            int r = rng() % 100;
+            if (r < 5 && !coordinatorDown)
+            {
+                crashed.push_back(e.getCoordinator());
+                coordinatorDown = true;
+            }
+            else if (r < 15 && !crashed.empty())
+            {
+                // Classic bully: a recovered process above the coordinator
+                // takes over right away
+                size_t k = rng() % crashed.size();
+                int back = crashed[k];
+                crashed.erase(crashed.begin() + k);
+                if (back > e.getCoordinator() && !coordinatorDown)
+                    e.runBully(back, crashed, {}, st); // refused while the lease holds
+            }
+            else if (r < 70)
+            {
+                if (!coordinatorDown && e.leaseValid())
+                    localReads++;
+                else
+                    remoteReads++;
+            }
+            else if (!coordinatorDown)
+                e.renewLease();
+
+            if (coordinatorDown)
+            {
+                // Followers notice the missing heartbeat
+                int initiator;
+                do
+                    initiator = ids[rng() % n];
+                while (find(crashed.begin(), crashed.end(), initiator) != crashed.end());
+                if (e.runBully(initiator, crashed, {}, st) != -1)
+                    coordinatorDown = false;
+            }
+        }
+
+        cout << (mode == 0 ? "no-lease" : "lease") << "," << n << "," << steps << "," << e.getTerm() << ","
+             << st.denied << "," << st.messages << "," << localReads << "," << remoteReads << "\n";
+    }
+}
+
+// Usage: election --trace [n] [elections] [file] [seed]
+// Runs alternating bully/ring elections with the recorder attached,
+// writes the Chrome trace to `file` and prints per-phase latency
+// histograms as CSV.
+void runTraceBenchmark(long n, int elections, const string &file, unsigned seed)
+{
+    mt19937 rng(seed);
+    vector<int> ids = generateIds(n, rng);
+    TraceRecorder recorder(1 << 20);
+    Election e;
+    e.setVerbose(false);
+    e.setTrackParticipants(false);
+    e.setTrace(&recorder);
+
+    for (int i = 0; i < elections; i++)
+    {
+        e.load(ids);
+        ElectionStats st;
+        vector<int> crashed = {ids.back()};
+        vector<int> cascade = {ids[n - 2]};
+        int initiator = ids[rng() % (n - 2)];
+        if (i % 2 == 0)
+            e.runBully(initiator, crashed, cascade, st);
+        else
+            e.runRing(initiator, crashed, cascade, st);
+    }
+
+    ofstream out(file);
+    if (!out)
+    {
+        cerr << "Error: Cannot open file " << file << endl;
+        return;
+    }
+    recorder.exportChrome(out);
+    cerr << recorder.size() << " events written to " << file << endl;
+    recorder.printHistograms(cout);
+}
+
+// Usage: election --hier [maxN] [fanout] [seed]
+// Builds the hierarchy for n = 10 .. maxN, crashes the coordinator and
+// compares the subtree re-election with a flat bully election. Both
+// message columns include announcing the new coordinator to every live
+// process.
+void runHierarchicalBenchmark(long maxN, int fanout, unsigned seed)
+{
+    cout << "n,fanout,depth,build_messages,build_hops,build_us,crash_messages,crash_hops,crash_us,flat_bully_messages\n";
+    mt19937 rng(seed);
+    int workers = max(1u, thread::hardware_concurrency());
+
+    for (long n = 10; n <= maxN; n *= 10)
+    {
+        vector<int> ids = generateIds(n, rng);
+        Election e;
+        e.setVerbose(false);
+        e.load(ids);
+
+        ElectionStats build;
+        auto t0 = chrono::steady_clock::now();
+        e.runHierarchical(fanout, {}, workers, build);
+        auto t1 = chrono::steady_clock::now();
+
+        ElectionStats crash;
+        e.crashHierarchical(ids.back(), crash);
+        auto t2 = chrono::steady_clock::now();
+        size_t depth = e.hierarchyDepth(); // load() below drops the tree
+
+        ElectionStats flat;
+        e.load(ids);
+        e.runBully(ids[rng() % (n - 1)], {ids.back()}, {}, flat);
+
+        cout << n << "," << fanout << "," << depth << "," << build.messages << "," << build.hops << ","
+             << chrono::duration<double, micro>(t1 - t0).count() << "," << crash.messages << ","
+             << crash.hops << "," << chrono::duration<double, micro>(t2 - t1).count() << ","
+             << flat.messages << "\n";
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc > 1 && string(argv[1]) == "--hier")
+    {
+        long maxN = argc > 2 ? atol(argv[2]) : 1000000;
+        int fanout = argc > 3 ? atoi(argv[3]) : 16;
+        unsigned seed = argc > 4 ? atoi(argv[4]) : 42;
+        runHierarchicalBenchmark(maxN, max(fanout, 2), seed);
+        return 0;
+    }
+    if (argc > 1 && string(argv[1]) == "--trace")
+    {
+        long n = argc > 2 ? atol(argv[2]) : 1000;
+        int elections = argc > 3 ? atoi(argv[3]) : 100;
+        string file = argc > 4 ? argv[4] : "election_trace.json";
+        unsigned seed = argc > 5 ? atoi(argv[5]) : 42;
+        runTraceBenchmark(max(n, 4L), elections, file, seed);
+        return 0;
+    }
+    if (argc > 1 && string(argv[1]) == "--flap")
+    {
+        long n = argc > 2 ? atol(argv[2]) : 1000;
+        int steps = argc > 3 ? atoi(argv[3]) : 100000;
+        unsigned seed = argc > 4 ? atoi(argv[4]) : 42;
+        runFlapBenchmark(max(n, 3L), steps, seed);
+        return 0;
+    }
+    if (argc > 1 && string(argv[1]) == "--concurrent")
+    {
+        long n = argc > 2 ? atol(argv[2]) : 100000;
+        int maxK = argc > 3 ? atoi(argv[3]) : 1024;
+        unsigned seed = argc > 4 ? atoi(argv[4]) : 42;
+        runConcurrentBenchmark(max(n, 3L), max(maxK, 1), seed);
+        return 0;
+    }
+
+    if (argc > 1 && string(argv[1]) == "--bench")
+    {
+        long maxN = argc > 2 ? atol(argv[2]) : 1000000;
+        unsigned seed = argc > 3 ? atoi(argv[3]) : 42;
+        int crashes = argc > 4 ? atoi(argv[4]) : 1;
+        int cascade = argc > 5 ? atoi(argv[5]) : 2;
+        int reps = argc > 6 ? atoi(argv[6]) : 3;
+        runBenchmark(maxN, seed, max(crashes, 1), cascade, max(reps, 1));
+        return 0;
+    }
+
     Election e;
     int ch;
     cout << "\n===== ELECTION ALGORITHM SIMULATION =====\n";
@@ -153,7 +1280,7 @@ int main()
 
     do
     {
-        cout << "\n1. Bully Algorithm\n2. Ring Algorithm\n3. Show Coordinator\n4. Exit\n";
+        cout << "\n1. Bully Algorithm\n2. Ring Algorithm\n3. Concurrent Initiators\n4. Hierarchical Election\n5. Show Coordinator\n6. Exit\n";
         cout << "Enter choice: ";
         cin >> ch;
 
@@ -166,15 +1293,21 @@ int main()
             e.ring();
             break;
         case 3:
-            e.show();
+            e.concurrent();
             break;
         case 4:
+            e.hierarchical();
+            break;
+        case 5:
+            e.show();
+            break;
+        case 6:
             cout << "Exiting simulation...\n";
             break;
         default:
             cout << "Invalid choice!\n";
         }
-    } while (ch != 4);
+    } while (ch != 6);
 
     return 0;
 }
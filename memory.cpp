@@ -1,7 +1,27 @@
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <thread>
+#include <chrono>
 using namespace std;
 
+// A live allocation, so compaction knows what it can move
+struct Allocation
+{
+    int pid;
+    int size;
+    int block; // 0-based
+};
+
+// One entry of the relocation table handed back to clients
+struct Relocation
+{
+    int pid;
+    int size;
+    int from;
+    int to;
+};
+
 void displayBlocks(const vector<int> &blocks)
 {
     cout << "\nRemaining memory in each block:\n";
@@ -14,7 +34,7 @@ void displayBlocks(const vector<int> &blocks)
 }
 
 // ---------------- FIRST FIT ----------------
-bool firstFit(vector<int> &blocks, int process, int pid)
+int firstFit(vector<int> &blocks, int process, int pid)
 {
     for (int j = 0; j < blocks.size(); j++)
     {
@@ -23,15 +43,15 @@ bool firstFit(vector<int> &blocks, int process, int pid)
             cout << "Process " << pid << " (Size " << process
                  << ") -> Block " << j + 1 << endl;
             blocks[j] -= process;
-            return true;
+            return j;
         }
     }
     cout << "Process " << pid << " (Size " << process << ") -> Not Allocated\n";
-    return false;
+    return -1;
 }
 
 // ---------------- BEST FIT ----------------
-bool bestFit(vector<int> &blocks, int process, int pid)
+int bestFit(vector<int> &blocks, int process, int pid)
 {
     int bestIdx = -1;
     for (int j = 0; j < blocks.size(); j++)
@@ -47,17 +67,17 @@ bool bestFit(vector<int> &blocks, int process, int pid)
         cout << "Process " << pid << " (Size " << process
              << ") -> Block " << bestIdx + 1 << endl;
         blocks[bestIdx] -= process;
-        return true;
+        return bestIdx;
     }
     else
     {
         cout << "Process " << pid << " (Size " << process << ") -> Not Allocated\n";
-        return false;
+        return -1;
     }
 }
 
 // ---------------- WORST FIT ----------------
-bool worstFit(vector<int> &blocks, int process, int pid)
+int worstFit(vector<int> &blocks, int process, int pid)
 {
     int worstIdx = -1;
     for (int j = 0; j < blocks.size(); j++)
@@ -73,17 +93,17 @@ bool worstFit(vector<int> &blocks, int process, int pid)
         cout << "Process " << pid << " (Size " << process
              << ") -> Block " << worstIdx + 1 << endl;
         blocks[worstIdx] -= process;
-        return true;
+        return worstIdx;
     }
     else
     {
         cout << "Process " << pid << " (Size " << process << ") -> Not Allocated\n";
-        return false;
+        return -1;
     }
 }
 
 // ---------------- NEXT FIT ----------------
-bool nextFit(vector<int> &blocks, int process, int pid, int &pos)
+int nextFit(vector<int> &blocks, int process, int pid, int &pos)
 {
     int n = blocks.size();
     int count = 0;
@@ -94,14 +114,234 @@ bool nextFit(vector<int> &blocks, int process, int pid, int &pos)
             cout << "Process " << pid << " (Size " << process
                  << ") -> Block " << pos + 1 << endl;
             blocks[pos] -= process;
+            int chosen = pos;
             pos = (pos + 1) % n;
-            return true;
+            return chosen;
         }
         pos = (pos + 1) % n;
         count++;
     }
     cout << "Process " << pid << " (Size " << process << ") -> Not Allocated\n";
-    return false;
+    return -1;
+}
+
+// ---------------- COMPACTION ----------------
+// When a request fails although the total free space is enough, live
+// allocations are moved out of one target block into the free space of
+// the others until the request fits there. Every block is tried as a
+// target; the candidates are split across worker threads and the plan
+// that moves the fewest bytes wins.
+
+// Places `evict` (moved out of block t) into the other blocks, largest
+// first, each into the tightest block that still fits; empty if any
+// allocation has nowhere to go
+vector<Relocation> placeEvictions(const vector<int> &blocks, vector<Allocation> evict, int t)
+{
+    sort(evict.begin(), evict.end(), [](const Allocation &a, const Allocation &b)
+         { return a.size > b.size; });
+    vector<int> space = blocks;
+    vector<Relocation> moves;
+    for (const Allocation &a : evict)
+    {
+        int dest = -1;
+        for (size_t j = 0; j < space.size(); j++)
+            if ((int)j != t && space[j] >= a.size && (dest == -1 || space[j] < space[dest]))
+                dest = j;
+        if (dest == -1)
+            return vector<Relocation>();
+        space[dest] -= a.size;
+        moves.push_back({a.pid, a.size, t, dest});
+    }
+    return moves;
+}
+
+// Plans the moves that free `need` bytes in block t, moving as few bytes
+// as possible; empty if impossible. Blocks with up to 16 allocations are
+// searched exhaustively; larger ones fall back to a single covering move
+// or to accumulating the largest allocations first.
+vector<Relocation> planForTarget(const vector<int> &blocks, const vector<Allocation> &allocs, int t, int need)
+{
+    vector<Relocation> best;
+    int shortfall = need - blocks[t];
+    if (shortfall <= 0)
+        return best;
+
+    vector<Allocation> inBlock;
+    for (const Allocation &a : allocs)
+        if (a.block == t)
+            inBlock.push_back(a);
+    sort(inBlock.begin(), inBlock.end(), [](const Allocation &a, const Allocation &b)
+         { return a.size < b.size; });
+    long bestBytes = -1;
+
+    if (inBlock.size() <= 16)
+    {
+        for (unsigned mask = 1; mask < (1u << inBlock.size()); mask++)
+        {
+            vector<Allocation> evict;
+            long bytes = 0;
+            for (size_t i = 0; i < inBlock.size(); i++)
+            {
+                if (mask & (1u << i))
+                {
+                    evict.push_back(inBlock[i]);
+                    bytes += inBlock[i].size;
+                }
+            }
+            if (bytes < shortfall || (bestBytes != -1 && bytes >= bestBytes))
+                continue;
+            vector<Relocation> moves = placeEvictions(blocks, evict, t);
+            if (!moves.empty())
+            {
+                best = moves;
+                bestBytes = bytes;
+            }
+        }
+        return best;
+    }
+
+    // Smallest single allocation that covers the shortfall on its own
+    for (const Allocation &a : inBlock)
+    {
+        if (a.size < shortfall)
+            continue;
+        best = placeEvictions(blocks, vector<Allocation>(1, a), t);
+        if (!best.empty())
+            return best;
+    }
+
+    // Otherwise take the largest allocations until the shortfall is covered
+    vector<Allocation> evict;
+    long bytes = 0;
+    for (auto it = inBlock.rbegin(); it != inBlock.rend() && bytes < shortfall; ++it)
+    {
+        evict.push_back(*it);
+        bytes += it->size;
+    }
+    if (bytes >= shortfall)
+        best = placeEvictions(blocks, evict, t);
+    return best;
+}
+
+long bytesMoved(const vector<Relocation> &moves)
+{
+    long total = 0;
+    for (const Relocation &r : moves)
+        total += r.size;
+    return total;
+}
+
+// Cheapest plan over all target blocks, evaluated by `workers` threads
+vector<Relocation> planCompaction(const vector<int> &blocks, const vector<Allocation> &allocs, int need, int workers)
+{
+    int nb = blocks.size();
+    workers = max(1, min(workers, nb));
+    vector<vector<Relocation>> best(workers);
+    vector<thread> pool;
+
+    for (int w = 0; w < workers; w++)
+    {
+        pool.emplace_back([&, w]()
+                          {
+            for (int t = w; t < nb; t += workers)
+            {
+                vector<Relocation> plan = planForTarget(blocks, allocs, t, need);
+                if (!plan.empty() && (best[w].empty() || bytesMoved(plan) < bytesMoved(best[w])))
+                    best[w] = plan;
+            } });
+    }
+    for (thread &th : pool)
+        th.join();
+
+    vector<Relocation> chosen;
+    for (vector<Relocation> &plan : best)
+        if (!plan.empty() && (chosen.empty() || bytesMoved(plan) < bytesMoved(chosen)))
+            chosen = plan;
+    return chosen;
+}
+
+// Applies one relocation and updates the allocation record for its client
+void applyRelocation(vector<int> &blocks, vector<Allocation> &allocs, const Relocation &r)
+{
+    for (Allocation &a : allocs)
+    {
+        if (a.pid == r.pid)
+        {
+            a.block = r.to;
+            break;
+        }
+    }
+    blocks[r.from] += r.size;
+    blocks[r.to] -= r.size;
+}
+
+// Runs the plan either in one pause (stop-the-world) or in pauses that
+// each move at most `pauseBudget` bytes (at least one allocation).
+// Returns the pause times in microseconds.
+vector<double> runCompaction(vector<int> &blocks, vector<Allocation> &allocs,
+                             const vector<Relocation> &plan, bool incremental, int pauseBudget)
+{
+    vector<double> pauses;
+    size_t i = 0;
+    while (i < plan.size())
+    {
+        auto start = chrono::steady_clock::now();
+        long moved = 0;
+        do
+        {
+            applyRelocation(blocks, allocs, plan[i]);
+            moved += plan[i].size;
+            i++;
+        } while (i < plan.size() && (!incremental || moved + plan[i].size <= pauseBudget));
+        auto end = chrono::steady_clock::now();
+        pauses.push_back(chrono::duration<double, micro>(end - start).count());
+    }
+    return pauses;
+}
+
+// Offers compaction after a failed request; returns true if it now fits
+bool compactFor(vector<int> &blocks, vector<Allocation> &allocs, int process)
+{
+    long totalFree = 0;
+    for (int b : blocks)
+        totalFree += b;
+    if (totalFree < process)
+    {
+        cout << "Total free memory (" << totalFree << ") is too small, compaction cannot help.\n";
+        return false;
+    }
+
+    cout << "Total free memory is " << totalFree << " but fragmented across blocks.\n";
+    cout << "Compact memory?\n1. Stop-the-world\n2. Incremental\n3. Skip\nEnter choice: ";
+    int mode;
+    cin >> mode;
+    if (mode != 1 && mode != 2)
+        return false;
+    int budget = 0;
+    if (mode == 2)
+    {
+        cout << "Enter pause budget (bytes moved per pause): ";
+        cin >> budget;
+    }
+
+    int workers = max(1u, thread::hardware_concurrency());
+    vector<Relocation> plan = planCompaction(blocks, allocs, process, workers);
+    if (plan.empty())
+    {
+        cout << "No relocation plan can make room for " << process << ".\n";
+        return false;
+    }
+
+    vector<double> pauses = runCompaction(blocks, allocs, plan, mode == 2, budget);
+
+    cout << "\nRelocation table:\n";
+    cout << "Process\tSize\tFrom\tTo\n";
+    for (const Relocation &r : plan)
+        cout << r.pid << "\t" << r.size << "\t" << r.from + 1 << "\t" << r.to + 1 << endl;
+    double maxPause = *max_element(pauses.begin(), pauses.end());
+    cout << "Bytes moved: " << bytesMoved(plan) << ", pauses: " << pauses.size()
+         << ", max pause: " << maxPause << " us\n";
+    return true;
 }
 
 // ---------------- MAIN ----------------
@@ -123,6 +363,7 @@ int main()
         cin >> processes[i];
 
     int nextPos = 0; // For next fit tracking
+    vector<Allocation> allocations;
     cout << "\n===== MEMORY ALLOCATION (Choose strategy per process) =====\n";
 
     for (int i = 0; i < np; i++)
@@ -134,24 +375,33 @@ int main()
         int choice;
         cin >> choice;
 
-        bool success = false;
-        switch (choice)
+        int block = -1;
+        for (int attempt = 0; attempt < 2; attempt++)
         {
-        case 1:
-            success = firstFit(blocks, processes[i], i + 1);
-            break;
-        case 2:
-            success = bestFit(blocks, processes[i], i + 1);
-            break;
-        case 3:
-            success = worstFit(blocks, processes[i], i + 1);
-            break;
-        case 4:
-            success = nextFit(blocks, processes[i], i + 1, nextPos);
-            break;
-        default:
-            cout << "Invalid choice! Process skipped.\n";
+            switch (choice)
+            {
+            case 1:
+                block = firstFit(blocks, processes[i], i + 1);
+                break;
+            case 2:
+                block = bestFit(blocks, processes[i], i + 1);
+                break;
+            case 3:
+                block = worstFit(blocks, processes[i], i + 1);
+                break;
+            case 4:
+                block = nextFit(blocks, processes[i], i + 1, nextPos);
+                break;
+            default:
+                cout << "Invalid choice! Process skipped.\n";
+            }
+            // Retry once after a successful compaction
+            if (block != -1 || choice < 1 || choice > 4 || attempt == 1 ||
+                !compactFor(blocks, allocations, processes[i]))
+                break;
         }
+        if (block != -1)
+            allocations.push_back({i + 1, processes[i], block});
 
         displayBlocks(blocks);
         cout << "Press Enter to continue...\n";